@@ -6,6 +6,31 @@
 extern "C" {
 #endif
 
+/* Inline caches of the LOAD_GLOBAL and LOAD_ATTR instructions.
+   See Python/ceval.c for their use. */
+typedef struct {
+    PY_UINT64_T globals_ver;    /* ma_version_tag of f_globals */
+    PY_UINT64_T builtins_ver;   /* ma_version_tag of f_builtins */
+    PyObject *ptr;              /* borrowed reference to the value */
+} _PyOpcache_LoadGlobal;
+
+typedef struct {
+    struct _typeobject *type;   /* borrowed reference to the type */
+    unsigned int tp_version_tag;
+    unsigned int type_epoch;    /* _PyType_CacheEpoch */
+    PyObject *descr;            /* borrowed result of _PyType_Lookup() */
+    Py_ssize_t hint;            /* entry of the name in the instance dict */
+} _PyOpcache_LoadAttr;
+
+typedef struct {
+    union {
+        _PyOpcache_LoadGlobal lg;
+        _PyOpcache_LoadAttr la;
+    } u;
+    char optimized;             /* LOAD_ATTR: 0 empty, > 0 remaining
+                                   refills, < 0 disabled */
+} _PyOpcache;
+
 /* Bytecode object */
 typedef struct {
     PyObject_HEAD
@@ -27,6 +52,20 @@ typedef struct {
 				   Objects/lnotab_notes.txt for details. */
     void *co_zombieframe;     /* for optimization only (see frameobject.c) */
     PyObject *co_weakreflist;   /* to support weakrefs to code objects */
+    /* inline caches, created after the code ran _PyCode_OPCACHE_MIN_RUNS
+       times. co_opcache_map maps instruction offsets to 1-based indices
+       into co_opcache. */
+    unsigned char *co_opcache_map;
+    _PyOpcache *co_opcache;
+    int co_opcache_flag;        /* number of runs so far */
+    unsigned char co_opcache_size;
+    /* copy of co_code with superinstructions, created together with the
+       inline caches. Same layout as co_code, see Python/peephole.c. */
+    unsigned char *co_fused_code;
+    /* pool of zombie frames, co_zombieframe is the first one.
+       See frameobject.c. */
+    int co_nzombies;            /* number of frames in the pool */
+    int co_zombiemax;           /* number of frames the pool may hold */
 } PyCodeObject;
 
 /* Masks for co_flags above */
@@ -82,6 +121,9 @@ PyCode_NewEmpty(const char *filename, const char *funcname, int firstlineno);
    use PyFrame_GetLineNumber() instead. */
 PyAPI_FUNC(int) PyCode_Addr2Line(PyCodeObject *, int);
 
+#define _PyCode_OPCACHE_MIN_RUNS 1024
+PyAPI_FUNC(int) _PyCode_InitOpcache(PyCodeObject *);
+
 /* for internal use only */
 #define _PyCode_GETCODEPTR(co, pp) \
 	((*Py_TYPE((co)->co_code)->tp_as_buffer->bf_getreadbuffer) \
@@ -110,6 +152,8 @@ PyAPI_FUNC(PyObject*) _PyCode_ConstantKey(PyObject *obj);
 PyAPI_FUNC(PyObject*) PyCode_Optimize(PyObject *code, PyObject* consts,
                                       PyObject *names, PyObject *lineno_obj);
 
+PyAPI_FUNC(int) _PyCode_FuseSuperinstructions(PyCodeObject *);
+
 #ifdef __cplusplus
 }
 #endif
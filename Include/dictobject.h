@@ -14,78 +14,69 @@ extern "C" {
 */
 
 /*
-There are three kinds of slots in the table:
-
-1. Unused.  me_key == me_value == NULL
-   Does not hold an active (key, value) pair now and never did.  Unused can
-   transition to Active upon key insertion.  This is the only case in which
-   me_key is NULL, and is each slot's initial state.
-
-2. Active.  me_key != NULL and me_key != dummy and me_value != NULL
-   Holds an active (key, value) pair.  Active can transition to Dummy upon
-   key deletion.  This is the only case in which me_value != NULL.
-
-3. Dummy.  me_key == dummy and me_value == NULL
-   Previously held an active (key, value) pair, but that was deleted and an
-   active pair has not yet overwritten the slot.  Dummy can transition to
-   Active upon key insertion.  Dummy slots cannot be made Unused again
-   (cannot have me_key set to NULL), else the probe sequence in case of
-   collision would have no way to know they were once active.
-
-Note: .popitem() abuses the me_hash field of an Unused or Dummy slot to
-hold a search finger.  The me_hash field of Unused or Dummy slots has no
-meaning otherwise.
+The table of a dict is split in two parts, see Objects/dictobject.c for
+the details:
+
+1. The hash table proper.  Its slots hold the index of an entry, and are
+   only 1, 2, 4 or 8 bytes wide, depending on the size of the table.
+   There are three kinds of slots:  Unused slots never held an entry,
+   Active slots hold the index of an entry, and Dummy slots held an entry
+   that was deleted.  Dummy slots cannot be made Unused again, else the
+   probe sequence in case of collision would have no way to know they were
+   once active.
+
+2. A dense array of PyDictEntry, in the order of insertion.  Deleted
+   entries have me_key == me_value == NULL until the array is compacted.
+
+Iterating over a dict visits the slots in order, not the entries.
+
+The instance dicts of a class may share one table (key-sharing dicts, see
+PEP 412).  Such a split dict keeps its values in the separate array
+ma_values; the entries of the shared table hold the keys and hashes only.
 */
 
-/* PyDict_MINSIZE is the minimum size of a dictionary.  This many slots are
- * allocated directly in the dict object (in the ma_smalltable member).
- * It must be a power of 2, and at least 4.  8 allows dicts with no more
- * than 5 active entries to live in ma_smalltable (and so avoid an
- * additional malloc); instrumentation suggested this suffices for the
+/* PyDict_MINSIZE is the minimum size of a dictionary.  It must be a power
+ * of 2, and at least 4.  8 allows dicts with no more than 5 active entries
+ * to use the minimum table; instrumentation suggested this suffices for the
  * majority of dicts (consisting mostly of usually-small instance dicts and
- * usually-small dicts created to pass keyword arguments).
+ * usually-small dicts created to pass keyword arguments).  Empty dicts
+ * don't allocate a table at all.
  */
 #define PyDict_MINSIZE 8
 
 typedef struct {
-    /* Cached hash code of me_key.  Note that hash codes are C longs.
-     * We have to use Py_ssize_t instead because dict_popitem() abuses
-     * me_hash to hold a search finger.
-     */
+    /* Cached hash code of me_key.  Note that hash codes are C longs. */
     Py_ssize_t me_hash;
     PyObject *me_key;
     PyObject *me_value;
 } PyDictEntry;
 
+/* The table, private to Objects/dictobject.c */
+typedef struct _dictkeysobject PyDictKeysObject;
+
 /*
 To ensure the lookup algorithm terminates, there must be at least one Unused
-slot (NULL key) in the table.
-The value ma_fill is the number of non-NULL keys (sum of Active and Dummy);
-ma_used is the number of non-NULL, non-dummy keys (== the number of non-NULL
-values == the number of Active items).
-To avoid slowing down lookups on a near-full table, we resize the table when
-it's two-thirds full.
+slot in the table.  To avoid slowing down lookups on a near-full table, we
+resize the table when two-thirds of the slots are in use (Active or Dummy).
+ma_used is the number of Active slots and entries.
 */
 typedef struct _dictobject PyDictObject;
 struct _dictobject {
     PyObject_HEAD
-    Py_ssize_t ma_fill;  /* # Active + # Dummy */
     Py_ssize_t ma_used;  /* # Active */
 
-    /* The table contains ma_mask + 1 slots, and that's a power of 2.
-     * We store the mask instead of the size because the mask is more
-     * frequently needed.
+    /* Dictionary version: globally unique, changes on every modification
+     * of the dict. The eval loop uses it to validate its inline caches.
      */
-    Py_ssize_t ma_mask;
+    PY_UINT64_T ma_version_tag;
 
-    /* ma_table points to ma_smalltable for small tables, else to
-     * additional malloc'ed memory.  ma_table is never NULL!  This rule
-     * saves repeated runtime null-tests in the workhorse getitem and
-     * setitem calls.
+    /* Never NULL.  Empty dicts share a static table without entries. */
+    PyDictKeysObject *ma_keys;
+
+    /* NULL, unless ma_keys is shared.  Then the value of the entry i is
+     * ma_values[i], see Objects/dictobject.c.
      */
-    PyDictEntry *ma_table;
-    PyDictEntry *(*ma_lookup)(PyDictObject *mp, PyObject *key, long hash);
-    PyDictEntry ma_smalltable[PyDict_MINSIZE];
+    PyObject **ma_values;
 };
 
 PyAPI_DATA(PyTypeObject) PyDict_Type;
@@ -109,6 +100,10 @@ PyAPI_DATA(PyTypeObject) PyDictValues_Type;
 PyAPI_FUNC(PyObject *) PyDict_New(void);
 PyAPI_FUNC(PyObject *) PyDict_GetItem(PyObject *mp, PyObject *key);
 PyAPI_FUNC(PyObject *) _PyDict_GetItemWithError(PyObject *mp, PyObject *key);
+PyAPI_FUNC(PyObject *) _PyDict_GetItem_KnownHash(PyObject *mp, PyObject *key,
+                                                 long hash);
+PyAPI_FUNC(PyObject *) _PyDict_GetItemHint(PyObject *mp, PyObject *key,
+                                           long hash, Py_ssize_t *hint);
 PyAPI_FUNC(int) PyDict_SetItem(PyObject *mp, PyObject *key, PyObject *item);
 PyAPI_FUNC(int) PyDict_DelItem(PyObject *mp, PyObject *key);
 PyAPI_FUNC(int) _PyDict_DelItemIf(PyObject *mp, PyObject *key,
@@ -129,6 +124,13 @@ PyAPI_FUNC(int) _PyDict_Contains(PyObject *mp, PyObject *key, long hash);
 PyAPI_FUNC(PyObject *) _PyDict_NewPresized(Py_ssize_t minused);
 PyAPI_FUNC(void) _PyDict_MaybeUntrack(PyObject *mp);
 
+/* Key-sharing dicts for the instances of heap types */
+PyAPI_FUNC(PyDictKeysObject *) _PyDict_NewKeysForClass(void);
+PyAPI_FUNC(void) _PyDictKeys_DecRef(PyDictKeysObject *keys);
+PyAPI_FUNC(PyObject *) _PyObjectDict_New(PyTypeObject *tp);
+PyAPI_FUNC(int) _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr,
+                                      PyObject *key, PyObject *value);
+
 /* PyDict_Update(mp, other) is equivalent to PyDict_Merge(mp, other, 1). */
 PyAPI_FUNC(int) PyDict_Update(PyObject *mp, PyObject *other);
 
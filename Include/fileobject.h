@@ -30,6 +30,9 @@ typedef struct {
                                using f_fp with the GIL released. */
     int readable;
     int writable;
+#ifdef STACKLESS
+    int cooperative;            /* Read and write in a worker thread */
+#endif
 } PyFileObject;
 
 PyAPI_DATA(PyTypeObject) PyFile_Type;
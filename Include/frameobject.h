@@ -92,6 +92,10 @@ PyAPI_FUNC(void) PyFrame_FastToLocals(PyFrameObject *);
 
 PyAPI_FUNC(int) PyFrame_ClearFreeList(void);
 
+/* The pool of frames of a code object */
+PyAPI_FUNC(void) _PyFrame_FreePool(PyCodeObject *);
+PyAPI_FUNC(int) _PyFrame_Prewarm(PyCodeObject *, PyObject *, int);
+
 /* Return the line of code the frame is currently executing. */
 PyAPI_FUNC(int) PyFrame_GetLineNumber(PyFrameObject *);
 
@@ -101,13 +101,16 @@ PyAPI_FUNC(void) PyObject_Free(void *);
 
 /* Macros */
 #ifdef WITH_PYMALLOC
+PyAPI_FUNC(void) _PyObject_DebugMallocStats(void);
+/* Heaps of small blocks for tasklets, see tasklet.private_arena */
+PyAPI_FUNC(void *) _PyObject_NewHeap(void);
+PyAPI_FUNC(void) _PyObject_FreeHeap(void *);
 #ifdef PYMALLOC_DEBUG   /* WITH_PYMALLOC && PYMALLOC_DEBUG */
 PyAPI_FUNC(void *) _PyObject_DebugMalloc(size_t nbytes);
 PyAPI_FUNC(void *) _PyObject_DebugRealloc(void *p, size_t nbytes);
 PyAPI_FUNC(void) _PyObject_DebugFree(void *p);
 PyAPI_FUNC(void) _PyObject_DebugDumpAddress(const void *p);
 PyAPI_FUNC(void) _PyObject_DebugCheckAddress(const void *p);
-PyAPI_FUNC(void) _PyObject_DebugMallocStats(void);
 PyAPI_FUNC(void *) _PyObject_DebugMallocApi(char api, size_t nbytes);
 PyAPI_FUNC(void *) _PyObject_DebugReallocApi(char api, void *p, size_t nbytes);
 PyAPI_FUNC(void) _PyObject_DebugFreeApi(char api, void *p);
@@ -234,6 +237,15 @@ PyAPI_FUNC(PyVarObject *) _PyObject_NewVar(PyTypeObject *, Py_ssize_t);
 /* C equivalent of gc.collect(). */
 PyAPI_FUNC(Py_ssize_t) PyGC_Collect(void);
 
+/* Spend up to timeout seconds on the incremental collection of the oldest
+   generation, for schedulers with nothing else to do. */
+PyAPI_FUNC(Py_ssize_t) _PyGC_CollectIdle(double timeout);
+
+/* Move an object to the permanent generation, which the automatic
+   collections don't examine, and back again. */
+PyAPI_FUNC(void) _PyGC_Freeze(PyObject *op);
+PyAPI_FUNC(void) _PyGC_Thaw(PyObject *op);
+
 /* Test if a type has a GC head */
 #define PyType_IS_GC(t) PyType_HasFeature((t), Py_TPFLAGS_HAVE_GC)
 
@@ -280,6 +292,8 @@ extern PyGC_Head *_PyGC_generation0;
 #define _PyGC_REFS_UNTRACKED                    (-2)
 #define _PyGC_REFS_REACHABLE                    (-3)
 #define _PyGC_REFS_TENTATIVELY_UNREACHABLE      (-4)
+#define _PyGC_REFS_FROZEN                       (-5)
+#define _PyGC_REFS_VISITED                      (-6)
 
 /* Tell the GC to track this object.  NB: While the object is tracked the
  * collector it must be safe to call the ob_traverse method. */
@@ -159,6 +159,15 @@ extern "C" {
 #define SET_ADD         146
 #define MAP_ADD         147
 
+/* Superinstructions. They never appear in co_code, only in the copy of
+   the bytecode created by _PyCode_FuseSuperinstructions() */
+#define LOAD_FAST_LOAD_FAST             148
+#define LOAD_FAST_LOAD_CONST            149
+#define LOAD_FAST_LOAD_ATTR             150
+#define STORE_FAST_LOAD_FAST            151
+#define LOAD_CONST_RETURN_VALUE         152
+#define COMPARE_OP_POP_JUMP_IF_FALSE    153
+
 
 enum cmp_op {PyCmp_LT=Py_LT, PyCmp_LE=Py_LE, PyCmp_EQ=Py_EQ, PyCmp_NE=Py_NE, PyCmp_GT=Py_GT, PyCmp_GE=Py_GE,
 	     PyCmp_IN, PyCmp_NOT_IN, PyCmp_IS, PyCmp_IS_NOT, PyCmp_EXC_MATCH, PyCmp_BAD};